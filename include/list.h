@@ -1,12 +1,18 @@
 #ifndef LIST_H
 #define LIST_H
 
+#include <cstddef>
+#include <exception>
 #include <iostream>
 #include <initializer_list>
 #include <iterator>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
 
-using size_t = unsigned int;
+using std::size_t;
 
 namespace ls {
 
@@ -27,6 +33,107 @@ namespace ls {
             DNode *m_tail;
             size_t m_size;
 
+            // Número mínimo de nós por thread nas construções paralelas; abaixo disso o custo de criar threads não compensa
+            static const size_t PARALLEL_MIN_SEGMENT = 1 << 16;
+
+            // Cria uma cadeia independente de count nós com os valores get(first), get(first + 1), ...
+            // Em caso de exceção, os nós já criados são desalocados e head/tail ficam nulos
+            template <typename InputIt, typename Get>
+            static void build_chain( InputIt first, size_t count, Get get, DNode *& head, DNode *& tail )
+            {
+                head = tail = nullptr;
+                try {
+                    for (size_t i = 0; i < count; ++i, ++first) {
+                        DNode * temp = new DNode(get(first), nullptr, tail);
+                        if(tail == nullptr) head = temp;
+                        else tail->next = temp;
+                        tail = temp;
+                    }
+                } catch (...) {
+                    delete_chain(head);
+                    head = tail = nullptr;
+                    throw;
+                }
+            }
+
+            static void delete_chain( DNode * curr ) // Desaloca uma cadeia de nós terminada em nullptr
+            {
+                while (curr != nullptr) {
+                    DNode * aux {curr->next};
+                    delete curr;
+                    curr = aux;
+                }
+            }
+
+            // Cria a cadeia de cada segmento disjunto em uma thread e conecta as cadeias, em ordem, ao fim da
+            // lista. O segmento i começa em starts[i] e tem lengths[i] nós. Cada thread aloca seus nós com new,
+            // que no glibc é atendido pela arena de malloc da própria thread
+            template <typename InputIt, typename Get>
+            void append_segments( const std::vector<InputIt> & starts, const std::vector<size_t> & lengths, Get get )
+            {
+                size_t segments = starts.size();
+                std::vector<DNode *> heads(segments, nullptr);
+                std::vector<DNode *> tails(segments, nullptr);
+                std::vector<std::exception_ptr> errors(segments);
+                std::vector<std::thread> workers;
+                workers.reserve(segments - 1); // emplace_back não realoca enquanto houver threads em execução
+
+                struct joiner { // Garante o join das threads já criadas em qualquer caminho de saída
+                    std::vector<std::thread> & threads;
+                    ~joiner() { for (auto & thread : threads) if(thread.joinable()) thread.join(); }
+                } join_all{workers};
+
+                auto work = [&]( size_t i ) {
+                    try {
+                        build_chain(starts[i], lengths[i], get, heads[i], tails[i]);
+                    } catch (...) {
+                        errors[i] = std::current_exception();
+                    }
+                };
+
+                for (size_t i = 1; i < segments; ++i) {
+                    try {
+                        workers.emplace_back(work, i);
+                    } catch (...) {
+                        work(i); // Não foi possível criar a thread, o segmento é criado na thread atual
+                    }
+                }
+                work(0);
+                for (auto & worker : workers) worker.join();
+
+                for (size_t i = 0; i < segments; ++i) {
+                    if(errors[i]) {
+                        for (size_t j = 0; j < segments; ++j) delete_chain(heads[j]);
+                        std::rethrow_exception(errors[i]);
+                    }
+                }
+
+                // Conecta as cadeias ao fim da lista, em O(segments)
+                for (size_t i = 0; i < segments; ++i) {
+                    if(heads[i] == nullptr) continue;
+                    DNode * last{m_tail->prev};
+                    last->next = heads[i];
+                    heads[i]->prev = last;
+                    tails[i]->next = m_tail;
+                    m_tail->prev = tails[i];
+                }
+            }
+
+            // Quantidade de segmentos usada para construir count nós com até threads threads
+            static size_t segment_count( size_t count, unsigned threads )
+            {
+                size_t segments = threads == 0 ? 1 : threads;
+                size_t limit = count / PARALLEL_MIN_SEGMENT;
+                if(segments > limit) segments = limit;
+                return segments == 0 ? 1 : segments;
+            }
+
+            // Número de nós do segmento i quando count nós são divididos em segments segmentos
+            static size_t segment_length( size_t count, size_t segments, size_t i )
+            {
+                return count / segments + (i < count % segments ? 1 : 0);
+            }
+
         
         public:
             class const_iterator : public std::iterator<std::bidirectional_iterator_tag, T> 
@@ -40,7 +147,7 @@ namespace ls {
 
                     const_iterator & operator=( const const_iterator& ) = default;
                     const DNode & operator* (void) { return *m_ptr; }
-                    DNode * operator&(void) const { return m_ptr; }
+                    DNode * operator&(void) const { return const_cast<DNode *>(m_ptr); }
 
                     const_iterator & operator++ (void) { m_ptr = m_ptr->next; return *this; } // ++it
                     const_iterator operator++ ( int ) { iterator ret = *this; m_ptr = m_ptr->next; return ret; } // it++
@@ -156,6 +263,67 @@ namespace ls {
                  }
             }
 
+            list( list && other ) : list() // Move constructor - toma os nós de other, que fica vazia
+            {
+                std::swap(m_head, other.m_head);
+                std::swap(m_tail, other.m_tail);
+            }
+
+            // Constrói uma lista com os conteúdos do intervalo [first, last) usando até threads threads.
+            // Cada thread cria uma cadeia de nós para um segmento disjunto do intervalo, e as cadeias são
+            // conectadas em O(threads). Intervalos pequenos são construídos em uma única thread
+            template <typename RandomIt>
+            static list from_range( RandomIt first, RandomIt last, unsigned threads = std::thread::hardware_concurrency() )
+            {
+                list ret;
+                size_t count = last - first;
+                size_t segments = segment_count(count, threads);
+
+                std::vector<RandomIt> starts;
+                std::vector<size_t> lengths;
+                starts.reserve(segments);
+                lengths.reserve(segments);
+                for (size_t i = 0; i < segments; ++i) {
+                    starts.push_back(first);
+                    lengths.push_back(segment_length(count, segments, i));
+                    first += lengths.back();
+                }
+
+                // Retorna T por valor: *itr pode ser de outro tipo ou um proxy (ex.: vector<bool>)
+                ret.append_segments(starts, lengths, []( const RandomIt & itr ) { return T(*itr); });
+                return ret;
+            }
+
+            // Retorna uma cópia da lista construída em paralelo, como em from_range. Uma única passada pela
+            // lista conta os nós e guarda um nó a cada PARALLEL_MIN_SEGMENT; os segmentos começam nesses nós
+            list clone( unsigned threads = std::thread::hardware_concurrency() ) const
+            {
+                list ret;
+                std::vector<const_iterator> samples;
+                size_t count = 0;
+                for (const_iterator itr = cbegin(); itr != cend(); ++itr, ++count) {
+                    if(count % PARALLEL_MIN_SEGMENT == 0) samples.push_back(itr);
+                }
+                if(count == 0) return ret;
+
+                // segment_count nunca passa de count / PARALLEL_MIN_SEGMENT, então há amostras para todos os segmentos
+                size_t segments = segment_count(count, threads);
+                std::vector<const_iterator> starts;
+                std::vector<size_t> lengths;
+                starts.reserve(segments);
+                lengths.reserve(segments);
+                for (size_t i = 0; i < segments; ++i) {
+                    size_t sample = samples.size() * i / segments;
+                    size_t next = samples.size() * (i + 1) / segments;
+                    size_t end = (i + 1 < segments) ? next * PARALLEL_MIN_SEGMENT : count;
+                    starts.push_back(samples[sample]);
+                    lengths.push_back(end - sample * PARALLEL_MIN_SEGMENT);
+                }
+
+                ret.append_segments(starts, lengths, []( const_iterator itr ) -> const T & { return (*itr).data; });
+                return ret;
+            }
+
             // [II] ITERATORS
 
             iterator begin ( ) // Retorna um iterator apontado para o primeiro nó da lista
@@ -299,6 +467,23 @@ namespace ls {
                     delete temp;
                 }
             }
+            // Move o nó apontado por itr para a primeira posição da lista, apenas religando
+            // os ponteiros (nenhum nó é alocado ou desalocado)
+            void splice_front( iterator itr ) {
+                DNode * node{&itr};
+                if(node == m_head->next) return; // O nó já é o primeiro da lista
+
+                // Desconecta o nó de seus vizinhos
+                node->prev->next = node->next;
+                node->next->prev = node->prev;
+
+                // Conecta o nó entre m_head e o antigo primeiro nó
+                node->prev = m_head;
+                node->next = m_head->next;
+                (m_head->next)->prev = node;
+                m_head->next = node;
+            }
+
             void assign(const T & value ) {
                 DNode * curr{m_head->next};
 
@@ -476,7 +661,7 @@ namespace ls {
                 prev->next = next; // Conecta o nó anterior do itr ao itr->next
                 next->prev = prev; // Conecta o nó posterior do itr ao itr->prev
 
-                delete itr; // Deleta o nó passado pelo iterator
+                delete &itr; // Deleta o nó passado pelo iterator
                 return next; // Retorna o nó seguinte ao iterator
             }
 
@@ -490,7 +675,7 @@ namespace ls {
                 prev->next = next; // Conecta o nó anterior do itr ao itr->next
                 next->prev = prev; // Conecta o nó posterior do itr ao itr->prev
 
-                delete itr; // Deleta o nó passado pelo iterator
+                delete &itr; // Deleta o nó passado pelo iterator
                 return next; // Retorna o nó seguinte ao iterator               
             }
 
@@ -0,0 +1,197 @@
+#ifndef LRU_CACHE_H
+#define LRU_CACHE_H
+
+#include <functional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+#include "list.h"
+
+namespace ls {
+
+    // Cache LRU (least recently used) construído sobre ls::list. Os nós da lista guardam os pares
+    // (chave, valor) do mais recente (frente) para o menos recente (fim), e o unordered_map aponta
+    // cada chave para o seu nó. Um acerto apenas religa o nó para a frente da lista, e uma inserção
+    // com o cache cheio reaproveita o nó despejado da lista e do unordered_map (via extract), então
+    // nenhuma das duas operações aloca memória.
+    // K e V devem ter construtor default, pois a lista cria nós sentinela com T().
+    template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+    class lru_cache {
+
+        public:
+            using entry = std::pair<K, V>;
+            using eviction_callback = std::function<void(const K &, V &)>;
+
+        private:
+            using entry_list = list<entry>;
+            using iterator = typename entry_list::iterator;
+
+            entry_list m_entries; // Entradas em ordem de uso, da mais recente para a menos recente
+            std::unordered_map<K, iterator, Hash, KeyEqual> m_index; // Chave -> nó da lista
+            size_t m_size;
+            size_t m_capacity;
+            eviction_callback m_on_evict;
+
+            unsigned long long m_hits;
+            unsigned long long m_misses;
+            unsigned long long m_evictions;
+
+            iterator find_node( const K & key ) // Retorna o nó da chave ou m_entries.end() caso ela não esteja no cache
+            {
+                auto found = m_index.find(key);
+                if(found == m_index.end()) return m_entries.end();
+                return found->second;
+            }
+
+            void evict_back( ) // Remove a entrada menos recente, chamando o callback de despejo
+            {
+                iterator last = m_entries.end();
+                --last;
+
+                if(m_on_evict) m_on_evict((*last).data.first, (*last).data.second);
+
+                m_index.erase((*last).data.first);
+                m_entries.erase(last);
+                --m_size;
+                ++m_evictions;
+            }
+
+        public:
+            // [I] SPECIAL MEMBERS
+            explicit lru_cache( size_t capacity, eviction_callback on_evict = eviction_callback() )
+                : m_size{0}, m_capacity{capacity}, m_on_evict{std::move(on_evict)}, m_hits{0}, m_misses{0}, m_evictions{0}
+            {
+                if(capacity == 0) throw std::invalid_argument("lru_cache: capacity must be greater than zero");
+                m_index.reserve(capacity); // Evita rehash durante o uso
+            }
+
+            lru_cache( const lru_cache & ) = delete; // O índice guarda iterators para os nós desta lista
+            lru_cache & operator=( const lru_cache & ) = delete;
+
+            // [II] Lookup
+
+            // Retorna um ponteiro para o valor da chave e a marca como a mais recente, ou nullptr caso ela não esteja no cache
+            V * get( const K & key )
+            {
+                iterator itr = find_node(key);
+                if(itr == m_entries.end()) {
+                    ++m_misses;
+                    return nullptr;
+                }
+
+                ++m_hits;
+                m_entries.splice_front(itr); // Religa o nó para a frente, sem realocar
+                return &(*itr).data.second;
+            }
+
+            // Retorna um ponteiro para o valor da chave sem alterar a ordem de uso nem os contadores
+            V * peek( const K & key )
+            {
+                iterator itr = find_node(key);
+                if(itr == m_entries.end()) return nullptr;
+                return &(*itr).data.second;
+            }
+
+            bool contains( const K & key ) const // Retorna verdadeiro caso a chave esteja no cache
+            {
+                return m_index.find(key) != m_index.end();
+            }
+
+            // [III] Modifiers
+
+            // Insere ou atualiza a chave como a mais recente. Com o cache cheio, despeja a entrada menos
+            // recente e reaproveita o seu nó para a nova entrada
+            void put( const K & key, const V & value )
+            {
+                iterator itr = find_node(key);
+                if(itr != m_entries.end()) { // A chave já existe, apenas atualiza o valor
+                    (*itr).data.second = value;
+                    m_entries.splice_front(itr);
+                    return;
+                }
+
+                if(m_size == m_capacity) {
+                    iterator last = m_entries.end();
+                    --last;
+
+                    if(m_on_evict) m_on_evict((*last).data.first, (*last).data.second);
+
+                    // Reaproveita também o nó do unordered_map, trocando apenas a sua chave
+                    auto handle = m_index.extract((*last).data.first);
+                    ++m_evictions;
+
+                    try {
+                        handle.key() = key;
+                        (*last).data.first = key;
+                        (*last).data.second = value;
+                        m_index.insert(std::move(handle));
+                    } catch (...) {
+                        // A entrada antiga já saiu do índice, então o nó parcialmente sobrescrito sai da lista
+                        m_entries.erase(last);
+                        --m_size;
+                        throw;
+                    }
+                    m_entries.splice_front(last);
+                    return;
+                }
+
+                m_entries.push_front(entry(key, value));
+                try {
+                    m_index.emplace(key, m_entries.begin());
+                } catch (...) {
+                    m_entries.pop_front(); // Não deixa na lista um nó sem entrada no índice
+                    throw;
+                }
+                ++m_size;
+            }
+
+            bool erase( const K & key ) // Remove a chave do cache, retornando verdadeiro caso ela existisse
+            {
+                auto found = m_index.find(key);
+                if(found == m_index.end()) return false;
+
+                iterator itr = found->second;
+                m_index.erase(found);
+                m_entries.erase(itr);
+                --m_size;
+                return true;
+            }
+
+            void clear( ) // Remove todas as entradas sem chamar o callback de despejo
+            {
+                m_index.clear();
+                m_entries.clear();
+                m_size = 0;
+            }
+
+            // Altera a capacidade do cache, despejando as entradas menos recentes que não couberem
+            void set_capacity( size_t capacity )
+            {
+                if(capacity == 0) throw std::invalid_argument("lru_cache: capacity must be greater than zero");
+
+                m_capacity = capacity;
+                while (m_size > m_capacity) evict_back();
+                m_index.reserve(capacity);
+            }
+
+            void set_eviction_callback( eviction_callback on_evict ) { m_on_evict = std::move(on_evict); }
+
+            // [IV] Capacity
+
+            size_t size( ) const { return m_size; } // Número de entradas no cache, em O(1)
+            size_t capacity( ) const { return m_capacity; }
+            bool empty( ) const { return m_size == 0; }
+
+            // [V] Statistics
+
+            unsigned long long hits( ) const { return m_hits; } // Chamadas de get() que encontraram a chave
+            unsigned long long misses( ) const { return m_misses; } // Chamadas de get() que não encontraram a chave
+            unsigned long long evictions( ) const { return m_evictions; } // Entradas removidas por falta de espaço
+
+            void reset_stats( ) { m_hits = m_misses = m_evictions = 0; }
+    };
+
+}
+
+#endif
@@ -1,4 +1,185 @@
 #include "../include/list.h"
+#include "../include/lru_cache.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+static std::atomic<unsigned long long> g_alocacoes{0}; // Número de chamadas ao operator new, usado para verificar o lru_cache
+
+void * operator new( std::size_t bytes )
+{
+    ++g_alocacoes;
+    if(void * ptr = std::malloc(bytes)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete( void * ptr ) noexcept { std::free(ptr); }
+void operator delete( void * ptr, std::size_t ) noexcept { std::free(ptr); }
+
+static int g_falhas = 0; // Número de verificações que falharam
+
+void verifica( bool condicao, const char * descricao ) // Imprime o resultado de uma verificação
+{
+    std::cout << (condicao ? "[OK]     " : "[FALHOU] ") << descricao << "\n";
+    if(!condicao) ++g_falhas;
+}
+
+struct valor_instavel { // Valor cuja atribuição lança exceção quando lanca == true
+    int v;
+    static bool lanca;
+
+    valor_instavel( int x = 0 ) : v{x} {}
+    valor_instavel( const valor_instavel & ) = default;
+    valor_instavel & operator=( const valor_instavel & other ) {
+        if(lanca) throw std::runtime_error("atribuicao");
+        v = other.v;
+        return *this;
+    }
+};
+bool valor_instavel::lanca = false;
+
+void testa_erase( )
+{
+    std::cout << "\n--- erase ---\n";
+
+    ls::list<int> lista = {1, 2, 3, 4};
+    auto itr = lista.begin();
+    ++itr;
+    lista.erase(itr); // Remove o 2
+    verifica(lista.size() == 3 && lista.front() == 1 && (*++lista.begin()).data == 3, "erase(iterator) remove o nó apontado");
+
+    lista.erase(lista.cbegin()); // Remove o 1
+    verifica(lista.size() == 2 && lista.front() == 3 && lista.back() == 4, "erase(const_iterator) remove o nó apontado");
+}
+
+void testa_lru( )
+{
+    std::cout << "\n--- lru_cache ---\n";
+
+    std::string despejados;
+    ls::lru_cache<int, std::string> cache(3, [&]( const int & key, std::string & value ) {
+        despejados += std::to_string(key) + value + " ";
+    });
+
+    cache.put(1, "a");
+    cache.put(2, "b");
+    cache.put(3, "c");
+    verifica(*cache.get(1) == "a", "get encontra a chave inserida");
+
+    cache.put(4, "d"); // 2 é a entrada menos recente
+    verifica(!cache.contains(2) && cache.get(2) == nullptr, "put com o cache cheio despeja a entrada menos recente");
+    verifica(despejados == "2b ", "callback de despejo recebe a chave e o valor despejados");
+
+    unsigned long long hits = cache.hits(), misses = cache.misses();
+    verifica(*cache.peek(3) == "c" && cache.peek(9) == nullptr, "peek encontra apenas chaves existentes");
+    verifica(cache.hits() == hits && cache.misses() == misses, "peek não altera os contadores");
+    cache.put(5, "e"); // Ordem: 4 1 3 -> 3 continua sendo a menos recente após o peek
+    verifica(despejados == "2b 3c ", "peek não altera a ordem de uso");
+
+    verifica(cache.hits() == 1 && cache.misses() == 1 && cache.evictions() == 2, "contadores de acertos, falhas e despejos");
+
+    verifica(cache.erase(4) && !cache.erase(4) && cache.size() == 2, "erase remove a chave uma única vez");
+    cache.set_capacity(1);
+    verifica(cache.size() == 1 && cache.contains(5) && despejados == "2b 3c 1a ", "set_capacity despeja as entradas que não cabem");
+
+    ls::lru_cache<int, int> grande(1000);
+    for (int i = 0; i < 1000; ++i) grande.put(i, i);
+    unsigned long long antes = g_alocacoes;
+    for (int i = 0; i < 1000; ++i) grande.get(i);
+    verifica(g_alocacoes == antes, "acertos não alocam memória");
+    antes = g_alocacoes;
+    for (int i = 1000; i < 2000; ++i) grande.put(i, i);
+    verifica(g_alocacoes == antes && grande.evictions() == 1000, "put com despejo não aloca memória");
+
+    ls::lru_cache<int, valor_instavel> instavel(2);
+    instavel.put(1, 1);
+    instavel.put(2, 2);
+    valor_instavel::lanca = true;
+    bool lancou = false;
+    try { instavel.put(3, 3); } catch (const std::runtime_error &) { lancou = true; }
+    valor_instavel::lanca = false;
+    verifica(lancou && instavel.size() == 1 && !instavel.contains(1) && !instavel.contains(3), "exceção no put com despejo mantém o cache consistente");
+    instavel.put(4, 4);
+    instavel.put(5, 5);
+    verifica(instavel.size() == 2 && instavel.contains(4) && instavel.contains(5) && !instavel.contains(2), "cache continua despejando corretamente após a exceção");
+}
+
+struct copia_instavel { // Conta as instâncias vivas e lança exceção ao copiar o valor falha_em
+    int v;
+    static std::atomic<int> vivos; // Atualizado pelas threads de from_range
+    static int falha_em;
+
+    copia_instavel( int x = 0 ) : v{x} { ++vivos; }
+    copia_instavel( const copia_instavel & other ) : v{other.v} {
+        if(v == falha_em) throw std::runtime_error("copia");
+        ++vivos;
+    }
+    ~copia_instavel( ) { --vivos; }
+};
+std::atomic<int> copia_instavel::vivos{0};
+int copia_instavel::falha_em = -1;
+
+template <typename T>
+bool sequencia_igual( const ls::list<T> & lista, const std::vector<T> & esperado ) // Compara nos dois sentidos de percurso
+{
+    size_t i = 0;
+    auto itr = lista.cbegin();
+    for (; itr != lista.cend(); ++itr, ++i) {
+        if(i == esperado.size() || !((*itr).data == esperado[i])) return false;
+    }
+    if(i != esperado.size()) return false;
+
+    while (i > 0) {
+        --itr;
+        --i;
+        if(!((*itr).data == esperado[i])) return false;
+    }
+    return true;
+}
+
+void testa_construcao_paralela( )
+{
+    std::cout << "\n--- from_range / clone ---\n";
+
+    bool iguais = true;
+    for (unsigned threads : {1u, 3u, 8u}) {
+        for (size_t tamanho : {size_t(0), size_t(1), size_t(65535), size_t(300001)}) {
+            std::vector<int> valores(tamanho);
+            for (size_t i = 0; i < tamanho; ++i) valores[i] = static_cast<int>(i * 7 % 1000);
+
+            ls::list<int> lista = ls::list<int>::from_range(valores.begin(), valores.end(), threads);
+            const ls::list<int> & constante = lista;
+            ls::list<int> copia = constante.clone(threads);
+
+            iguais = iguais && sequencia_igual(lista, valores) && sequencia_igual(copia, valores);
+            copia.push_back(1);
+            copia.push_front(2);
+            iguais = iguais && copia.size() == tamanho + 2 && copia.front() == 2 && copia.back() == 1;
+        }
+    }
+    verifica(iguais, "from_range e clone reproduzem a sequência com 1, 3 e 8 threads");
+
+    std::vector<int> inteiros(300000, 7);
+    ls::list<long> longos = ls::list<long>::from_range(inteiros.begin(), inteiros.end(), 4);
+    verifica(longos.size() == 300000 && longos.front() == 7 && longos.back() == 7, "from_range converte o tipo dos elementos");
+
+    std::vector<bool> bits(200000);
+    for (size_t i = 0; i < bits.size(); ++i) bits[i] = (i % 3 == 0);
+    ls::list<bool> lista_bits = ls::list<bool>::from_range(bits.begin(), bits.end(), 4);
+    verifica(sequencia_igual(lista_bits, std::vector<bool>(bits)), "from_range aceita iterators proxy (vector<bool>)");
+
+    std::vector<copia_instavel> instaveis;
+    for (int i = 0; i < 300000; ++i) instaveis.emplace_back(i);
+    int vivos = copia_instavel::vivos;
+    copia_instavel::falha_em = 250000;
+    bool lancou = false;
+    try { ls::list<copia_instavel>::from_range(instaveis.begin(), instaveis.end(), 4); } catch (const std::runtime_error &) { lancou = true; }
+    copia_instavel::falha_em = -1;
+    verifica(lancou && copia_instavel::vivos == vivos, "exceção em uma thread desaloca todas as cadeias");
+}
 
 int main () {
     ls::list<int> exemplo( {1, 2, 3, 4} );
@@ -53,6 +234,12 @@ int main () {
         std::cout << "As listas sao iguais\n";
     } else { std::cout << "As listas sao diferentes\n";}
 
+    testa_erase();
+    testa_lru();
+    testa_construcao_paralela();
+
+    return g_falhas == 0 ? 0 : 1;
+
 
 
 